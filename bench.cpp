@@ -0,0 +1,63 @@
+#include <iostream>
+#include <vector>
+#include <memory>
+#include <chrono>
+#include <cstdlib>
+#include "game.h"
+
+// Stream buffer that discards everything, so sessions can draw without a terminal
+class NullBuffer : public std::streambuf {
+protected:
+    int overflow(int ch) override {
+        return ch;
+    }
+    std::streamsize xsputn(const char*, std::streamsize count) override {
+        return count;
+    }
+};
+
+// Measure how many idle sessions (sitting on the title screen) one core can host
+int main(int argc, char* argv[]) {
+    int sessionCount = argc > 1 ? std::atoi(argv[1]) : 10000;
+    if (sessionCount <= 0) {
+        std::cerr << "Usage: " << argv[0] << " [session count]" << std::endl;
+        return 1;
+    }
+    
+    NullBuffer nullBuffer;
+    std::ostream nullOut(&nullBuffer);
+    
+    // Create and initialize all sessions on this one thread
+    std::vector<std::unique_ptr<Game>> sessions;
+    sessions.reserve(sessionCount);
+    for (int i = 0; i < sessionCount; ++i) {
+        sessions.push_back(std::unique_ptr<Game>(new Game(nullOut)));
+        sessions.back()->initialize();
+    }
+    
+    // Tick every session repeatedly for about one second
+    auto startTime = std::chrono::steady_clock::now();
+    auto endTime = startTime;
+    long long ticks = 0;
+    do {
+        for (auto& session : sessions) {
+            session->update();
+        }
+        ticks += sessionCount;
+        endTime = std::chrono::steady_clock::now();
+    } while (endTime - startTime < std::chrono::seconds(1));
+    
+    double seconds = std::chrono::duration<double>(endTime - startTime).count();
+    double nsPerTick = seconds * 1e9 / ticks;
+    
+    // An idle session wants one update() per tick interval
+    int tickInterval = sessions.front()->getTickInterval();
+    double sessionsPerCore = tickInterval * 1e6 / nsPerTick;
+    
+    std::cout << "Sessions ticked: " << sessionCount << std::endl;
+    std::cout << "Bytes per session: " << sessions.front()->getMemoryFootprint() << std::endl;
+    std::cout << "Time per idle update(): " << nsPerTick << " ns" << std::endl;
+    std::cout << "Idle sessions per core at " << tickInterval << " ms ticks: "
+              << static_cast<long long>(sessionsPerCore) << std::endl;
+    return 0;
+}
@@ -1,7 +1,58 @@
 #include "dog.h"
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+const int Dog::MIN_POSITION;
+const int Dog::MAX_POSITION;
+const size_t Dog::MAX_NAMES;
+
+// Shared table of dog names; dogs with the same name share one entry.
+// The map owns the strings and never moves its elements, so the pointers
+// in names (and the references returned by getName()) stay valid.
+struct NameTable {
+    std::mutex lock;                                // Guards ids and names
+    std::unordered_map<std::string, uint16_t> ids;  // Name to index
+    std::vector<const std::string*> names;          // Index to name
+};
+
+static NameTable& nameTable() {
+    static NameTable table;
+    return table;
+}
+
+// Return the index of a name in the table, adding it if needed
+static uint16_t internName(const std::string& name) {
+    NameTable& table = nameTable();
+    std::lock_guard<std::mutex> guard(table.lock);
+    auto found = table.ids.find(name);
+    if (found != table.ids.end()) {
+        return found->second;
+    }
+    if (table.names.size() >= Dog::MAX_NAMES) {
+        throw std::length_error("Dog name table is full");
+    }
+    uint16_t id = static_cast<uint16_t>(table.names.size());
+    auto inserted = table.ids.emplace(name, id).first;
+    table.names.push_back(&inserted->first);
+    return id;
+}
+
+// Clamp a position into the range an int16_t can hold
+static int16_t clampPosition(long position) {
+    if (position < Dog::MIN_POSITION) {
+        return Dog::MIN_POSITION;
+    }
+    if (position > Dog::MAX_POSITION) {
+        return Dog::MAX_POSITION;
+    }
+    return static_cast<int16_t>(position);
+}
 
 Dog::Dog(char symbol, int initialPosition, bool isPlayer, const std::string& name) 
-    : symbol(symbol), position(initialPosition), isPlayer(isPlayer), name(name) {
+    : position(clampPosition(initialPosition)), symbol(symbol), isPlayer(isPlayer),
+      nameId(internName(name)) {
 }
 
 char Dog::getSymbol() const {
@@ -12,8 +63,10 @@ int Dog::getPosition() const {
     return position;
 }
 
-std::string Dog::getName() const {
-    return name;
+const std::string& Dog::getName() const {
+    NameTable& table = nameTable();
+    std::lock_guard<std::mutex> guard(table.lock);
+    return *table.names[nameId];
 }
 
 bool Dog::isPlayerControlled() const {
@@ -21,5 +74,22 @@ bool Dog::isPlayerControlled() const {
 }
 
 void Dog::move(int steps) {
-    position += steps;
-} 
\ No newline at end of file
+    position = clampPosition(static_cast<long>(position) + steps);
+}
+
+size_t Dog::getNameTableBytes() {
+    NameTable& table = nameTable();
+    std::lock_guard<std::mutex> guard(table.lock);
+    size_t bytes = sizeof(NameTable);
+    bytes += table.names.capacity() * sizeof(const std::string*);
+    bytes += table.ids.bucket_count() * sizeof(void*);
+    for (const auto& entry : table.ids) {
+        // Hash map node: next pointer, cached hash and the name/index pair
+        bytes += sizeof(void*) + sizeof(size_t) + sizeof(entry);
+        // Names too long for the string's inline buffer live on the heap
+        if (entry.first.capacity() > std::string().capacity()) {
+            bytes += entry.first.capacity() + 1;
+        }
+    }
+    return bytes;
+}
\ No newline at end of file
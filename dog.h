@@ -1,16 +1,29 @@
 #ifndef DOG_H
 #define DOG_H
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 
+// Compact dog state: the name is interned into a shared table and stored as
+// an index, so each dog only takes a few bytes. The table is guarded by a
+// mutex, so dogs can be built from any thread; it never shrinks.
 class Dog {
 private:
+    int16_t position;    // Position on the track, clamped to [MIN_POSITION, MAX_POSITION]
     char symbol;         // Dog's symbol, such as @, %, #
-    int position;        // Position on the track
     bool isPlayer;       // Whether it's player-controlled
-    std::string name;    // Dog's name
+    uint16_t nameId;     // Index of the dog's name in the shared name table
 
 public:
+    // Positions outside this range are clamped to it
+    static const int MIN_POSITION = INT16_MIN;
+    static const int MAX_POSITION = INT16_MAX;
+    
+    // Most distinct names the shared table can hold; constructing a dog with
+    // a new name beyond this throws std::length_error
+    static const size_t MAX_NAMES = UINT16_MAX + 1;
+    
     Dog(char symbol, int initialPosition, bool isPlayer, const std::string& name);
     
     // Get the dog's symbol
@@ -19,14 +32,20 @@ public:
     // Get the dog's position
     int getPosition() const;
     
-    // Get the dog's name
-    std::string getName() const;
+    // Get the dog's name; the reference stays valid for the whole program
+    const std::string& getName() const;
     
     // Check if it's player-controlled
     bool isPlayerControlled() const;
     
     // Move the dog
     void move(int steps);
+    
+    // Approximate heap and static bytes used by the shared name table
+    static size_t getNameTableBytes();
 };
 
-#endif // DOG_H 
\ No newline at end of file
+// Keep Dog small enough to host many races or huge fields
+static_assert(sizeof(Dog) < 8, "Dog should stay under 8 bytes");
+
+#endif // DOG_H
\ No newline at end of file
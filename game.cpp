@@ -33,65 +33,73 @@ int kbhit() {
 }
 
 // Clear the screen - Using more reliable multi-platform screen clearing method
-void clearScreen() {
+// Only writes escape sequences, so it never blocks the caller
+void clearScreen(std::ostream& out) {
     // Combine multiple screen clearing methods to ensure maximum effectiveness
     
     // Method 1: ANSI escape sequence for screen clearing (works in most terminals)
-    std::cout << "\033[2J"; // Clear entire screen
-    std::cout << "\033[3J"; // Clear scrollback buffer (in supported terminals)
-    std::cout << "\033[1;1H"; // Move cursor to top-left corner
-    std::cout.flush(); // Flush output immediately
+    out << "\033[2J"; // Clear entire screen
+    out << "\033[3J"; // Clear scrollback buffer (in supported terminals)
+    out << "\033[1;1H"; // Move cursor to top-left corner
+    out.flush(); // Flush output immediately
     
     // Method 2: Output multiple newlines to scroll the screen (universal method)
     for (int i = 0; i < 5; i++) {
-        std::cout << std::endl;
+        out << std::endl;
     }
     
     // Method 3: Set cursor position again to ensure subsequent output starts from the top
-    std::cout << "\033[1;1H" << std::flush;
-    
-    // Short delay to ensure above methods take effect
-    usleep(10000); // 10 milliseconds
+    out << "\033[1;1H" << std::flush;
 }
 
 // Set cursor position
-void setCursorPosition(int x, int y) {
-    std::cout << "\033[" << y << ";" << x << "H";
+void setCursorPosition(std::ostream& out, int x, int y) {
+    out << "\033[" << y << ";" << x << "H";
 }
 
 // Set text color
-void setConsoleColor(int colorCode) {
-    std::cout << "\033[" << colorCode << "m";
+void setConsoleColor(std::ostream& out, int colorCode) {
+    out << "\033[" << colorCode << "m";
 }
 
 // Hide cursor
-void hideCursor() {
-    std::cout << "\033[?25l";
+void hideCursor(std::ostream& out) {
+    out << "\033[?25l";
 }
 
 // Show cursor
-void showCursor() {
-    std::cout << "\033[?25h";
+void showCursor(std::ostream& out) {
+    out << "\033[?25h";
 }
 
-Game::Game() 
-    : track(100),                // Initialize track length to 100
+Game::Game(std::ostream& output) 
+    : output(output),            // Each session draws to its own stream
+      track(100),                // Initialize track length to 100
       playerDog('@', 0, true, "Player"),  // Initialize player's dog
       cpuDog1('%', -5, false, "CPU1"),  // Initialize CPU's dog 1, position at -5
       cpuDog2('#', -5, false, "CPU2"), // Initialize CPU's dog 2, position set to same as CPU1
-      gameOver(false) {
+      phase(GamePhase::Title),
+      lastCountdownShown(-1),
+      raceSeconds(0.0) {
     
     // Initialize random number generator
     std::random_device rd;
-    rng = std::mt19937(rd());
+    rng = std::minstd_rand(rd());
     
-    // Initialize last CPU dog move time
+    // Initialize last CPU dog move time and phase timers
     lastCpuMoveTime = std::chrono::steady_clock::now();
+    phaseStartTime = lastCpuMoveTime;
+    raceStartTime = lastCpuMoveTime;
+    
+    // Add all dogs to the track
+    track.addDog(&playerDog);
+    track.addDog(&cpuDog1);
+    track.addDog(&cpuDog2);
 }
 
 Game::~Game() {
     // In the destructor, ensure terminal settings are restored
-    showCursor();
+    showCursor(output);
 }
 
 void Game::initialize() {
@@ -100,25 +108,20 @@ void Game::initialize() {
     std::cerr << "DEBUG: Game initialization started..." << std::endl;
     #endif
     
-    // Add all dogs to the track
-    track.addDog(&playerDog);
-    track.addDog(&cpuDog1);
-    track.addDog(&cpuDog2);
-    
-    // Thoroughly clear the screen, ensuring no previous content remains
-    std::cout << "\033[2J\033[1;1H\033[3J" << std::flush; // Add \033[3J to clear scrollback buffer
-    std::cout.flush();
-    system("clear"); // Use system command to clear screen more thoroughly
-    
-    // Set up terminal
-    clearScreen();
-    hideCursor();
+    // Set up terminal; clearScreen() also clears the scrollback buffer
+    clearScreen(output);
+    hideCursor(output);
     
+    // Show the title screen; the SPACE key is handled by handleKey() instead of a wait loop
+    enterPhase(GamePhase::Title);
+}
+
+void Game::renderTitle() {
     // Only show the initial animation once to reduce repeated displays
-    clearScreen();
-    setConsoleColor(33); // Yellow
+    clearScreen(output);
+    setConsoleColor(output, 33); // Yellow
     
-    std::cout << R"(
+    output << R"(
         .--.--.
        /  ()  \
       |   ^^   |
@@ -126,39 +129,38 @@ void Game::initialize() {
        `------'  
 )" << std::endl;
     
-    setConsoleColor(37); // Bright white
-    std::cout << R"(
+    setConsoleColor(output, 37); // Bright white
+    output << R"(
     ╔═══════════════════════════════════╗
     ║          DOG RACE                 ║
     ╚═══════════════════════════════════╝
 )" << std::endl;
     
     // Add game instructions
-    setConsoleColor(36); // Cyan
+    setConsoleColor(output, 36); // Cyan
     // Display prompt information with alternating colors
-    setConsoleColor(32); // Green
-    std::cout << R"(
+    setConsoleColor(output, 32); // Green
+    output << R"(
     >>> Press SPACE to start! <<<
 )" << std::endl;
     
-    setConsoleColor(0); // Restore default color
-    
-    // Wait for spacebar, but no longer use looping animation
-    setConsoleColor(37); // Bright white
-    std::cout << "\n     Waiting for SPACE key..." << std::endl;
-    setConsoleColor(0); // Restore default color
+    setConsoleColor(output, 0); // Restore default color
     
-    // Simplified key waiting logic
-    while (true) {
-        if (kbhit()) {
-            char key = getchar();
-            if (key == ' ') break;
-        }
-        usleep(50000); // 50ms
+    setConsoleColor(output, 37); // Bright white
+    output << "\n     Waiting for SPACE key..." << std::endl;
+    setConsoleColor(output, 0); // Restore default color
+}
+
+void Game::renderCountdown(int number) {
+    clearScreen(output);
+    setConsoleColor(output, 33); // Yellow
+    if (number > 0) {
+        output << "\n\n              " << number << "..." << std::endl;
+    } else {
+        setConsoleColor(output, 32); // Green
+        output << "\n\n              GO!" << std::endl;
     }
-    
-    // Clear the screen again to ensure a clean interface before the game starts
-    clearScreen();
+    setConsoleColor(output, 0); // Restore default color
 }
 
 int Game::getRandomSteps(int min, int max) {
@@ -166,15 +168,6 @@ int Game::getRandomSteps(int min, int max) {
     return dist(rng);
 }
 
-void Game::handleInput() {
-    if (kbhit()) {
-        char key = getchar();
-        if (key == ' ') {
-            movePlayer();
-        }
-    }
-}
-
 void Game::movePlayer() {
     // Calculate the position difference between player and CPU dogs
     int diffWithCpu1 = playerDog.getPosition() - cpuDog1.getPosition();
@@ -215,51 +208,126 @@ void Game::updateCpuDogs() {
 }
 
 bool Game::isGameOver() const {
-    return gameOver;
+    return phase >= GamePhase::Finishing;
+}
+
+const Track& Game::getTrack() const {
+    return track;
+}
+
+size_t Game::getMemoryFootprint() const {
+    // Game embeds its dogs; the track keeps its dog pointers on the heap
+    return sizeof(Game) + track.getDogs().capacity() * sizeof(Dog*);
 }
 
 Dog* Game::getWinner() {
     return track.getWinner();
 }
 
-void Game::run() {
-    // Thoroughly clear the screen again before starting the main game loop
-    std::cout << "\033[2J\033[1;1H\033[3J" << std::flush; // Clear screen and scrollback buffer
-    std::cout.flush();
-    #ifndef _WIN32
-    system("clear"); // Use system clear command in non-Windows environments
-    #endif
-    clearScreen(); // Use our own clear screen function
+void Game::handleKey(char key) {
+    switch (phase) {
+    case GamePhase::Title:
+        if (key == ' ') {
+            enterPhase(GamePhase::Countdown);
+        }
+        break;
+    case GamePhase::Racing:
+        if (key == ' ') {
+            movePlayer();
+        }
+        break;
+    case GamePhase::Results:
+        // Any key leaves the results screen
+        enterPhase(GamePhase::Finished);
+        break;
+    default:
+        // Keys are ignored during the countdown and the finishing pause
+        break;
+    }
+}
+
+void Game::update() {
+    // Title, Results and Finished only react to keys, so skip the clock read
+    if (phase == GamePhase::Title || phase == GamePhase::Results || phase == GamePhase::Finished) {
+        return;
+    }
     
-    // Prepare the game main loop
-    auto startTime = std::chrono::steady_clock::now();
+    auto now = std::chrono::steady_clock::now();
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        now - phaseStartTime).count();
     
-    while (!gameOver) {
-        // Clear screen at the start of each loop to ensure a clean interface
-        // clearScreen(); // Remove this line because Track::render() already includes screen clearing
-        
-        handleInput();
+    switch (phase) {
+    case GamePhase::Countdown: {
+        // Show 3, 2, 1 for one second each, then "GO!" for half a second
+        if (elapsed >= 3500) {
+            enterPhase(GamePhase::Racing);
+            break;
+        }
+        int number = elapsed < 3000 ? 3 - static_cast<int>(elapsed / 1000) : 0;
+        if (number != lastCountdownShown) {
+            renderCountdown(number);
+            lastCountdownShown = number;
+        }
+        break;
+    }
+    case GamePhase::Racing:
         updateCpuDogs();
-        track.render();
+        track.render(output);
         
         if (track.isRaceFinished()) {
-            gameOver = true;
-            Dog* winner = getWinner();
-            auto endTime = std::chrono::steady_clock::now();
-            auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime);
-            double seconds = duration.count() / 1000.0;
-            
-            // Wait a short time to let the player see the final track state
-            usleep(1000000); // 1 second
-            
-            // Display the ending screen
-            clearScreen();
-            showCursor(); // Restore cursor at the end
-            
-            if (winner && winner->isPlayerControlled()) {
-                // Victory screen
-                setConsoleColor(32); // Green
-                std::cout << R"(
+            auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(now - raceStartTime);
+            raceSeconds = duration.count() / 1000.0;
+            enterPhase(GamePhase::Finishing);
+        }
+        break;
+    case GamePhase::Finishing:
+        // Wait a short time to let the player see the final track state
+        if (elapsed >= 1000) {
+            enterPhase(GamePhase::Results);
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+void Game::enterPhase(GamePhase next) {
+    phase = next;
+    phaseStartTime = std::chrono::steady_clock::now();
+    
+    switch (phase) {
+    case GamePhase::Title:
+        renderTitle();
+        break;
+    case GamePhase::Countdown:
+        lastCountdownShown = -1;
+        break;
+    case GamePhase::Racing:
+        // Clear the screen again before the race starts
+        clearScreen(output);
+        
+        // The race clock and CPU move timer start now, not at construction
+        raceStartTime = phaseStartTime;
+        lastCpuMoveTime = phaseStartTime;
+        break;
+    case GamePhase::Results:
+        // Display the ending screen
+        clearScreen(output);
+        showCursor(output); // Restore cursor at the end
+        renderResults();
+        break;
+    default:
+        break;
+    }
+}
+
+void Game::renderResults() {
+    Dog* winner = getWinner();
+    
+    if (winner && winner->isPlayerControlled()) {
+        // Victory screen
+        setConsoleColor(output, 32); // Green
+        output << R"(
     ╔═══════════════════════════════════════════════════╗
     ║                                                   ║
     ║                                                   ║
@@ -278,18 +346,18 @@ void Game::run() {
     ╚═══════════════════════════════════════════════════╝
 )" << std::endl;
 
-                setConsoleColor(33); // Yellow
-                std::cout << R"(
+        setConsoleColor(output, 33); // Yellow
+        output << R"(
          ✨ CONGRATULATIONS! ✨
 )" << std::endl;
-                
-                setConsoleColor(37); // Bright white
-                std::cout << "    Your dog finished in 1st place!\n" << std::endl;
-                std::cout << "    Time: " << std::fixed << std::setprecision(2) << seconds << " seconds\n" << std::endl;
-            } else {
-                // Defeat screen
-                setConsoleColor(31); // Red
-                std::cout << R"(
+        
+        setConsoleColor(output, 37); // Bright white
+        output << "    Your dog finished in 1st place!\n" << std::endl;
+        output << "    Time: " << std::fixed << std::setprecision(2) << raceSeconds << " seconds\n" << std::endl;
+    } else {
+        // Defeat screen
+        setConsoleColor(output, 31); // Red
+        output << R"(
     ╔═══════════════════════════════════════════════════╗
     ║                                                   ║
     ║                                                   ║
@@ -305,24 +373,45 @@ void Game::run() {
     ╚═══════════════════════════════════════════════════╝
 )" << std::endl;
 
-                setConsoleColor(33); // Yellow
-                std::cout << R"(
+        setConsoleColor(output, 33); // Yellow
+        output << R"(
          😢 Better luck next time! 😢
 )" << std::endl;
-                
-                setConsoleColor(37); // Bright white
-                std::cout << "    You finished in 3rd place...\n" << std::endl;
-            }
-            
-            setConsoleColor(0); // Restore default color
-            std::cout << "    Press any key to exit..." << std::endl;
-            getchar();
-        }
         
-        // Short delay between loops to control game speed
-        // Approximately 30ms delay, corresponding to about 33FPS
-        // usleep(30000);
-        // Increase delay to 100ms (10FPS) to reduce refresh frequency and improve flickering issues
-        usleep(100000);
+        setConsoleColor(output, 37); // Bright white
+        output << "    You finished in 3rd place...\n" << std::endl;
+    }
+    
+    setConsoleColor(output, 0); // Restore default color
+    output << "    Press any key to exit..." << std::endl;
+}
+
+GamePhase Game::getPhase() const {
+    return phase;
+}
+
+bool Game::isFinished() const {
+    return phase == GamePhase::Finished;
+}
+
+int Game::getTickInterval() const {
+    // The race refreshes at 100ms (10FPS) to reduce flickering;
+    // other phases only poll for keys, so a shorter interval keeps them responsive
+    if (phase == GamePhase::Racing || phase == GamePhase::Finishing) {
+        return 100;
     }
-} 
\ No newline at end of file
+    return 50;
+}
+
+void Game::run() {
+    // Single event loop for a session on the process terminal: poll stdin once
+    // per tick and advance the phase. Drivers hosting many sessions skip run()
+    // and call handleKey()/update() on each Game with keys from their own source.
+    while (!isFinished()) {
+        if (kbhit()) {
+            handleKey(static_cast<char>(getchar()));
+        }
+        update();
+        usleep(getTickInterval() * 1000);
+    }
+}
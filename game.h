@@ -1,6 +1,8 @@
 #ifndef GAME_H
 #define GAME_H
 
+#include <cstdint>
+#include <iostream>
 #include <vector>
 #include <random>
 #include <chrono>
@@ -8,47 +10,106 @@
 #include "dog.h"
 #include "track.h"
 
+// Phases of a race session, advanced one step at a time by Game::update()
+enum class GamePhase : uint8_t {
+    Title,      // Title screen, waiting for SPACE
+    Countdown,  // 3-2-1-GO before the race starts
+    Racing,     // Race in progress
+    Finishing,  // Race over, showing the final track state briefly
+    Results,    // Victory/defeat screen, waiting for any key
+    Finished    // Session is done
+};
+
 class Game {
 private:
+    std::ostream& output;        // Stream this session draws to
     Track track;                 // Track
     Dog playerDog;               // Player's dog
     Dog cpuDog1;                 // CPU's dog 1
     Dog cpuDog2;                 // CPU's dog 2
-    bool gameOver;               // Whether the game is over
+    GamePhase phase;             // Current phase of the session
     
-    std::mt19937 rng;            // Random number generator
+    // Random number generator; minstd_rand keeps only one word of state,
+    // unlike the ~5 KB of std::mt19937, which is plenty for dice-like steps
+    std::minstd_rand rng;
     
     // Last time the CPU dogs moved
     std::chrono::time_point<std::chrono::steady_clock> lastCpuMoveTime;
     
+    // Time the current phase was entered
+    std::chrono::time_point<std::chrono::steady_clock> phaseStartTime;
+    
+    // Time the race started, used for the result time
+    std::chrono::time_point<std::chrono::steady_clock> raceStartTime;
+    
+    // Last countdown number shown, so it is only drawn when it changes
+    int lastCountdownShown;
+    
+    // Race duration in seconds, measured when a dog crosses the finish line
+    double raceSeconds;
+    
     // Get random movement steps
     int getRandomSteps(int min, int max);
     
-    // Handle player input
-    void handleInput();
-    
     // Update CPU dog positions
     void updateCpuDogs();
     
+    // Switch to a new phase and draw its entry screen
+    void enterPhase(GamePhase next);
+    
+    // Draw the title screen
+    void renderTitle();
+    
+    // Draw the countdown number (0 means "GO!")
+    void renderCountdown(int number);
+    
+    // Draw the victory or defeat screen
+    void renderResults();
+    
 public:
-    // Constructor
-    Game();
+    // Constructor, draws to the given stream (the terminal by default)
+    explicit Game(std::ostream& output = std::cout);
+    
+    // The track points at this game's own dogs, so a game cannot be copied or moved
+    Game(const Game&) = delete;
+    Game& operator=(const Game&) = delete;
     
     // Destructor
     ~Game();
     
-    // Initialize the game
+    // Initialize the game and show the title screen
     void initialize();
     
-    // Game main loop
+    // Game main loop, drives this session until it finishes
     void run();
     
+    // Feed one key press to the current phase; only writes to the output stream
+    void handleKey(char key);
+    
+    // Advance the current phase by one tick; never sleeps or waits for input
+    void update();
+    
+    // Get the current phase
+    GamePhase getPhase() const;
+    
+    // Check if the session is done and can be discarded
+    bool isFinished() const;
+    
+    // Suggested delay before the next update() in milliseconds
+    int getTickInterval() const;
+    
     // Player moves on space press
     void movePlayer();
     
-    // Check if the game is over
+    // Check if the race is over (Finishing phase or later)
     bool isGameOver() const;
     
+    // Get the track and its dogs
+    const Track& getTrack() const;
+    
+    // Bytes used by this session, including the track's heap storage
+    size_t getMemoryFootprint() const;
+    
     // Get the winner
     Dog* getWinner();
 };
@@ -2,6 +2,8 @@
 #include <cstdlib>
 #include <ctime>
 #include <fstream>
+#include <cstring>
+#include <sstream>
 // Add platform detection headers
 #ifdef _WIN32
 #include <windows.h>
@@ -39,7 +41,28 @@ bool acquireLock() {
     #endif
 }
 
-int main() {
+// Print the memory footprint of one race
+void printFootprint() {
+    // Build a race without drawing it to see how many dogs it holds
+    std::ostringstream discard;
+    Game probe(discard);
+    const std::vector<Dog*>& dogs = probe.getTrack().getDogs();
+    
+    size_t raceBytes = probe.getMemoryFootprint() - dogs.size() * sizeof(Dog);
+    
+    std::cout << "Dogs per race: " << dogs.size() << std::endl;
+    std::cout << "Bytes per dog: " << sizeof(Dog) << std::endl;
+    std::cout << "Bytes per race (excluding dogs): " << raceBytes << std::endl;
+    std::cout << "Shared name table (all races, approximate): " << Dog::getNameTableBytes() << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    // Report memory usage instead of playing
+    if (argc > 1 && std::strcmp(argv[1], "--footprint") == 0) {
+        printFootprint();
+        return 0;
+    }
+    
     // Ensure only one game instance is running
     if (!acquireLock()) {
         std::cerr << "Error: Game is already running!" << std::endl;
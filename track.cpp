@@ -41,33 +41,33 @@ const std::vector<Dog*>& Track::getDogs() const {
     return dogs;
 }
 
-void Track::render() const {
+void Track::render(std::ostream& out) const {
     // Only move cursor to the top-left corner, do not clear screen content
-    // Since Game::run() already has clearScreen() operation, no need to repeat screen clearing here
-    // Removed screen clearing command: std::cout << "\033[2J";
-    std::cout << "\033[1;1H" << std::flush; // Move cursor to top-left corner
+    // Since Game already clears the screen when the race starts, no need to repeat screen clearing here
+    // Removed screen clearing command: out << "\033[2J";
+    out << "\033[1;1H" << std::flush; // Move cursor to top-left corner
     
     // Display game title
-    std::cout << "\033[33m"; // Yellow
-    std::cout << "╔═══════════════════════ DOG RACE ════════════════════════╗" << std::endl;
-    std::cout << "\033[37m"; // White
+    out << "\033[33m"; // Yellow
+    out << "╔═══════════════════════ DOG RACE ════════════════════════╗" << std::endl;
+    out << "\033[37m"; // White
     
     // Get ranking information
     auto ranking = getRanking();
     
     // Display positions and rankings of all dogs
-    std::cout << "\033[36m"; // Cyan
-    std::cout << "║  ";
+    out << "\033[36m"; // Cyan
+    out << "║  ";
     
     // Display player dog information
     for (const auto& dog : dogs) {
         if (dog->isPlayerControlled()) {
-            std::cout << "You(@): " << std::setw(3) << dog->getPosition() << "/" << length;
+            out << "You(@): " << std::setw(3) << dog->getPosition() << "/" << length;
             
             // Display player ranking
             for (size_t i = 0; i < ranking.size(); ++i) {
                 if (ranking[i]->isPlayerControlled()) {
-                    std::cout << " [" << (i + 1) << "st]";
+                    out << " [" << (i + 1) << "st]";
                     break;
                 }
             }
@@ -76,26 +76,26 @@ void Track::render() const {
     }
     
     // Fill with spaces for layout alignment
-    std::cout << std::string(26, ' ') << "║" << std::endl;
+    out << std::string(26, ' ') << "║" << std::endl;
     
     // Display CPU dog information
-    std::cout << "║  ";
+    out << "║  ";
     bool firstCpu = true;
     for (const auto& dog : dogs) {
         if (!dog->isPlayerControlled()) {
             if (!firstCpu) {
-                std::cout << " | ";
+                out << " | ";
             }
-            std::cout << dog->getName() << "(" << dog->getSymbol() << "): " << std::setw(3) << dog->getPosition();
+            out << dog->getName() << "(" << dog->getSymbol() << "): " << std::setw(3) << dog->getPosition();
             firstCpu = false;
         }
     }
     
     // Fill with spaces for layout alignment
-    std::cout << std::string(26, ' ') << "║" << std::endl;
+    out << std::string(26, ' ') << "║" << std::endl;
     
-    std::cout << "\033[37m"; // Reset to white
-    std::cout << "╠════════════════════════════════════════════════════════╣" << std::endl;
+    out << "\033[37m"; // Reset to white
+    out << "╠════════════════════════════════════════════════════════╣" << std::endl;
     
     // Draw track area
     for (const auto& dog : dogs) {
@@ -113,35 +113,35 @@ void Track::render() const {
         }
         
         // Dog color
-        std::cout << "║ ";
+        out << "║ ";
         if (dog->getSymbol() == '@') {
-            std::cout << "\033[32m"; // Green for player dog
+            out << "\033[32m"; // Green for player dog
         } else if (dog->getSymbol() == '%') {
-            std::cout << "\033[31m"; // Red for CPU1 dog
+            out << "\033[31m"; // Red for CPU1 dog
         } else {
-            std::cout << "\033[34m"; // Blue for CPU2 dog
+            out << "\033[34m"; // Blue for CPU2 dog
         }
         
         // Print track
-        std::cout << trackBody;
+        out << trackBody;
         
         // Finish line
-        std::cout << "\033[37m"; // Bright white
-        std::cout << "║";
-        std::cout << "\033[33m"; // Yellow
-        std::cout << "▌▌";
-        std::cout << "\033[37m"; // Reset to white
-        std::cout << " ║" << std::endl;
+        out << "\033[37m"; // Bright white
+        out << "║";
+        out << "\033[33m"; // Yellow
+        out << "▌▌";
+        out << "\033[37m"; // Reset to white
+        out << " ║" << std::endl;
     }
     
     // Draw bottom border
-    std::cout << "\033[33m"; // Yellow
-    std::cout << "╚════════════════════════════════════════════════════════╝" << std::endl;
+    out << "\033[33m"; // Yellow
+    out << "╚════════════════════════════════════════════════════════╝" << std::endl;
     
     // Prompt information
-    std::cout << "\033[37m"; // Bright white
-    std::cout << "  Press SPACE to make your dog (@) move forward!" << std::endl;
-    std::cout << "\033[0m"; // Reset all attributes
+    out << "\033[37m"; // Bright white
+    out << "  Press SPACE to make your dog (@) move forward!" << std::endl;
+    out << "\033[0m"; // Reset all attributes
 }
 
 std::vector<Dog*> Track::getRanking() const {
@@ -2,6 +2,7 @@
 #define TRACK_H
 
 #include <vector>
+#include <ostream>
 #include "dog.h"
 
 class Track {
@@ -31,8 +32,8 @@ public:
     // Get all dogs
     const std::vector<Dog*>& getDogs() const;
     
-    // Render the track state
-    void render() const;
+    // Render the track state to the given stream
+    void render(std::ostream& out) const;
     
     // Get the current ranking of dogs
     std::vector<Dog*> getRanking() const;